@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "bounded_double_heap.h"
+
+/*
+ * this file implements a data structure called "bounded_double_heap", a double heap
+ * (see "double_heap.c") which retains a fixed number of elements, but instead of
+ * rejecting new elements once it's full, it evicts the most extreme elements it holds.
+ * the retained elements are split between two min-max heaps (see "min_max_heap.c"):
+ * "lower" holds the retained elements below the median and "upper" holds the rest,
+ * so the median is the minimum of "upper", and the two extremes which may be evicted
+ * are the minimum of "lower" and the maximum of "upper", all retrieved in constant
+ * time. the structure counts the elements evicted below and above the retained ones,
+ * and remembers the largest of the first and the smallest of the last: a new element
+ * which is not larger than the first, or not smaller than the last, is only counted
+ * and never retained. so all the elements counted below are not larger than any of
+ * the retained elements, and all the elements counted above are not smaller than any
+ * of them, and the rank of the median among the retained elements is known exactly.
+ * the median is therefore exact as long as this rank lies inside the retained band,
+ * and each eviction is made from the end which keeps the median closer to the
+ * middle of the band. the header of this file contains the definition of the structure.
+ */
+
+/*
+ * construct_bounded_double_heap:
+ * this function constructs an empty bounded_double_heap which retains up to
+ * "capacity" elements and returns a pointer to the caller. each of the min-max
+ * heaps has room for one more element than the capacity, since a new element is
+ * inserted before an element is evicted.
+ */
+bounded_double_heap *construct_bounded_double_heap(int capacity){
+    bounded_double_heap *new_bounded_double_heap = (bounded_double_heap*)malloc(sizeof(bounded_double_heap));
+    new_bounded_double_heap->lower = construct_min_max_heap(capacity + 1);
+    new_bounded_double_heap->upper = construct_min_max_heap(capacity + 1);
+    new_bounded_double_heap->capacity = capacity;
+    new_bounded_double_heap->retained_count = 0;
+    new_bounded_double_heap->evicted_below = 0;
+    new_bounded_double_heap->evicted_above = 0;
+    new_bounded_double_heap->low_bound = 0;
+    new_bounded_double_heap->high_bound = 0;
+    return new_bounded_double_heap;
+}
+
+/*
+ * free_bounded_double_heap:
+ * frees the dynamically allocated memory to the "bounded_double_heap_object".
+ */
+void free_bounded_double_heap(bounded_double_heap *bounded_double_heap_object){
+    free_min_max_heap(bounded_double_heap_object->lower);
+    free_min_max_heap(bounded_double_heap_object->upper);
+    free(bounded_double_heap_object);
+}
+
+/*
+ * median_rank:
+ * returns the rank of the (upper) median of all the elements inserted so far
+ * among the retained elements, starting from 1 for the smallest. if it's smaller
+ * than 1 or larger than the number of retained elements, the median was evicted.
+ */
+static int median_rank(bounded_double_heap *bounded_double_heap_object){
+    int count = bounded_double_heap_items_count(bounded_double_heap_object);
+    return count/2 + 1 - bounded_double_heap_object->evicted_below;
+}
+
+/*
+ * evict:
+ * removes one of the extreme retained elements: the minimum if the median lies
+ * in the upper half of the retained band, otherwise the maximum, and updates the
+ * matching count and bound.
+ */
+static void evict(bounded_double_heap *bounded_double_heap_object){
+    min_max_heap *lower = bounded_double_heap_object->lower, *upper = bounded_double_heap_object->upper;
+    if (2*median_rank(bounded_double_heap_object) > bounded_double_heap_object->retained_count + 1){
+        if (min_max_heap_items_count(lower) > 0)
+            bounded_double_heap_object->low_bound = min_max_heap_extract_min(lower);
+        else
+            bounded_double_heap_object->low_bound = min_max_heap_extract_min(upper);
+        (bounded_double_heap_object->evicted_below)++;
+    }
+    else {
+        if (min_max_heap_items_count(upper) > 0)
+            bounded_double_heap_object->high_bound = min_max_heap_extract_max(upper);
+        else
+            bounded_double_heap_object->high_bound = min_max_heap_extract_max(lower);
+        (bounded_double_heap_object->evicted_above)++;
+    }
+    (bounded_double_heap_object->retained_count)--;
+}
+
+/*
+ * rebalance:
+ * moves elements between the heaps until "lower" holds exactly the retained
+ * elements below the median, so the median is the minimum of "upper". if the
+ * median is outside the retained band, "lower" ends up either empty or holding
+ * all the retained elements. since each insert changes the median's rank and
+ * the size of "lower" by at most one each, at most two elements are moved.
+ */
+static void rebalance(bounded_double_heap *bounded_double_heap_object){
+    min_max_heap *lower = bounded_double_heap_object->lower, *upper = bounded_double_heap_object->upper;
+    int target = median_rank(bounded_double_heap_object) - 1;
+    if (target < 0)
+        target = 0;
+    else if (target > bounded_double_heap_object->retained_count)
+        target = bounded_double_heap_object->retained_count;
+    while (min_max_heap_items_count(lower) > target)
+        min_max_heap_insert(upper, min_max_heap_extract_max(lower));
+    while (min_max_heap_items_count(lower) < target)
+        min_max_heap_insert(lower, min_max_heap_extract_min(upper));
+}
+
+/*
+ * bounded_double_heap_insert:
+ * inserts key in the "bounded_double_heap_object". a key which is not larger than
+ * the largest element evicted below, or not smaller than the smallest element evicted
+ * above, lies outside the retained band, so it's only counted with them. otherwise,
+ * the key is inserted into "lower" if it's smaller than its maximum, or into "upper"
+ * if not, and in case the capacity is exceeded as a result, one extreme element is
+ * evicted. finally, the heaps are rebalanced around the new median. this function
+ * runs in logarithmic time, Theta( log c ), where "c" is the capacity.
+ */
+void bounded_double_heap_insert(bounded_double_heap *bounded_double_heap_object, int key){
+    min_max_heap *lower = bounded_double_heap_object->lower, *upper = bounded_double_heap_object->upper;
+    if (bounded_double_heap_object->evicted_below > 0 && key <= bounded_double_heap_object->low_bound)
+        (bounded_double_heap_object->evicted_below)++;
+    else if (bounded_double_heap_object->evicted_above > 0 && key >= bounded_double_heap_object->high_bound)
+        (bounded_double_heap_object->evicted_above)++;
+    else {
+        if (min_max_heap_items_count(lower) > 0 && key < min_max_heap_max(lower))
+            min_max_heap_insert(lower, key);
+        else
+            min_max_heap_insert(upper, key);
+        if (++(bounded_double_heap_object->retained_count) > bounded_double_heap_object->capacity)
+            evict(bounded_double_heap_object);
+    }
+    rebalance(bounded_double_heap_object);
+}
+
+/*
+ * bounded_double_heap_median:
+ * returns the (upper) median of all the elements inserted so far, which is the
+ * minimum of "upper", in constant time. if the median was evicted, the nearest
+ * retained element is returned instead, which is the minimum of "upper" too, or
+ * the maximum of "lower" if "upper" is empty ("bounded_double_heap_median_is_exact"
+ * tells the two cases apart). -1 is returned in case no elements are retained.
+ */
+int bounded_double_heap_median(bounded_double_heap *bounded_double_heap_object){
+    if (bounded_double_heap_object->retained_count == 0)
+        return -1;
+    else if (min_max_heap_items_count(bounded_double_heap_object->upper) > 0)
+        return min_max_heap_min(bounded_double_heap_object->upper);
+    else
+        return min_max_heap_max(bounded_double_heap_object->lower);
+}
+
+/*
+ * bounded_double_heap_median_is_exact:
+ * returns 1 if the median returned by "bounded_double_heap_median" is the exact
+ * median of all the elements inserted so far, that is, if its rank lies inside
+ * the retained band, else, it returns 0.
+ */
+int bounded_double_heap_median_is_exact(bounded_double_heap *bounded_double_heap_object){
+    int rank = median_rank(bounded_double_heap_object);
+    return 1 <= rank && rank <= bounded_double_heap_object->retained_count;
+}
+
+/*
+ * bounded_double_heap_items_count:
+ * given a bounded_double_heap pointer, this function returns the total number
+ * of elements inserted into it, both retained and evicted.
+ */
+int bounded_double_heap_items_count(bounded_double_heap *bounded_double_heap_object){
+    return bounded_double_heap_object->retained_count + bounded_double_heap_object->evicted_below
+            + bounded_double_heap_object->evicted_above;
+}
\ No newline at end of file
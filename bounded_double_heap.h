@@ -0,0 +1,36 @@
+#ifndef BOUNDED_DOUBLE_HEAP_H
+#define BOUNDED_DOUBLE_HEAP_H
+
+    #include "min_max_heap.h"
+
+	/*
+	 * bounded_double_heap:
+	 * is a structure that holds the members of a double heap of fixed capacity,
+	 * which never rejects new elements. it contains two min-max heaps: "lower" holds
+	 * the retained elements below the median and "upper" holds the rest. "capacity"
+	 * is the maximum number of elements retained and "retained_count" is the current
+	 * number of elements held by both heaps. the most extreme elements are evicted
+	 * when the capacity is reached, "evicted_below" and "evicted_above" count the
+	 * elements evicted (or never retained) below and above the retained ones, and
+	 * "low_bound" and "high_bound" are the largest and smallest of them respectively
+	 * (meaningful only if the matching count is not 0).
+	 */
+    typedef struct bounded_double_heap {
+        min_max_heap *lower;
+        min_max_heap *upper;
+        int capacity;
+        int retained_count;
+        int evicted_below;
+        int evicted_above;
+        int low_bound;
+        int high_bound;
+    } bounded_double_heap;
+
+    bounded_double_heap *construct_bounded_double_heap(int);
+    void free_bounded_double_heap(bounded_double_heap*);
+    void bounded_double_heap_insert(bounded_double_heap*, int);
+    int bounded_double_heap_median(bounded_double_heap*);
+    int bounded_double_heap_median_is_exact(bounded_double_heap*);
+    int bounded_double_heap_items_count(bounded_double_heap*);
+
+#endif
\ No newline at end of file
@@ -124,4 +124,124 @@ int double_heap_median(double_heap *double_heap_object){
  */
 int double_heap_items_count(double_heap *double_heap_object){
     return double_heap_object->elements_count;
+}
+
+/*
+ * sift_up_min / sift_up_max:
+ * restore the heap property of a minimum (maximum) heap stored in "data" after
+ * "key" was placed at index "i", by moving the parents down along the path to
+ * the root until the right place for "key" is found. unlike "heap_insert", the
+ * key is written only once, at the end, instead of being swapped at each level.
+ */
+static void sift_up_min(int *data, size_t i, int key){
+    size_t p;
+    while (i > 0 && key < data[p = (i - 1)/2]){
+        data[i] = data[p];
+        i = p;
+    }
+    data[i] = key;
+}
+
+static void sift_up_max(int *data, size_t i, int key){
+    size_t p;
+    while (i > 0 && key > data[p = (i - 1)/2]){
+        data[i] = data[p];
+        i = p;
+    }
+    data[i] = key;
+}
+
+/*
+ * PREFETCH:
+ * hints the processor to start loading the cache line holding "address",
+ * used by the running medians kernel to fetch the next level of a sift down
+ * path while the current one is being compared. compilers which don't offer
+ * such a builtin simply get an empty statement.
+ */
+#ifdef __GNUC__
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void)0)
+#endif
+
+/*
+ * sift_down_min / sift_down_max:
+ * replace the root of a minimum (maximum) heap of "size" elements stored in
+ * "data" with "key", and restore the heap property by moving the extreme child
+ * up along the path to a leaf until the right place for "key" is found. the
+ * children of the children are prefetched, so the next level of the path is
+ * already on its way when it's compared.
+ */
+static void sift_down_min(int *data, size_t size, int key){
+    size_t i = 0, child;
+    while ((child = 2*i + 1) < size){
+        if (2*child + 1 < size)
+            PREFETCH(&data[2*child + 1]);
+        if (child + 1 < size && data[child + 1] < data[child])
+            child++;
+        if (key <= data[child])
+            break;
+        data[i] = data[child];
+        i = child;
+    }
+    data[i] = key;
+}
+
+static void sift_down_max(int *data, size_t size, int key){
+    size_t i = 0, child;
+    while ((child = 2*i + 1) < size){
+        if (2*child + 1 < size)
+            PREFETCH(&data[2*child + 1]);
+        if (child + 1 < size && data[child + 1] > data[child])
+            child++;
+        if (key >= data[child])
+            break;
+        data[i] = data[child];
+        i = child;
+    }
+    data[i] = key;
+}
+
+/*
+ * double_heap_running_medians:
+ * a fused version of calling "double_heap_insert" followed by "double_heap_median"
+ * for each of the "n" elements of "in": after the function returns, "out[i]" holds
+ * the (upper) median of "in[0]" to "in[i]". the function maintains the same two
+ * heaps and the same balance rules described above, but it keeps them in local
+ * arrays and sizes, compares the keys directly instead of going through
+ * "compare_function", and skips the overflow and underflow checks since both
+ * arrays are sized for "n" elements in advance. moving the top of one heap to the
+ * other while inserting the new key into the first is done with a single sift
+ * down (replacing the root with the key) instead of an extract and an insert.
+ * the function runs in Theta( n log n ) time and uses Theta( n ) extra memory.
+ */
+void double_heap_running_medians(const int *in, int *out, size_t n){
+    size_t i, min_count = 0, max_count = 0;
+    int key, *min_data, *max_data;
+    if (n == 0)
+        return;
+    min_data = (int *)malloc((n/2 + 1) * sizeof(int));
+    max_data = (int *)malloc((n/2 + 1) * sizeof(int));
+    for (i = 0; i < n; i++){
+        key = in[i];
+        if (min_count == max_count){
+            if (max_count == 0 || key >= max_data[0])
+                sift_up_min(min_data, min_count++, key);
+            else {
+                sift_up_min(min_data, min_count++, max_data[0]);
+                sift_down_max(max_data, max_count, key);
+            }
+        }
+        else {
+            if (key <= min_data[0])
+                sift_up_max(max_data, max_count++, key);
+            else {
+                sift_up_max(max_data, max_count++, min_data[0]);
+                sift_down_min(min_data, min_count, key);
+            }
+        }
+        out[i] = min_data[0];
+    }
+    free(min_data);
+    free(max_data);
 }
\ No newline at end of file
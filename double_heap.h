@@ -1,6 +1,7 @@
 #ifndef DOUBLE_HEAP_H
 #define DOUBLE_HEAP_H
     
+    #include <stddef.h>
     #include "heap.h"
 	
 	/*
@@ -23,5 +24,6 @@
     void double_heap_insert(double_heap*, int);
     int double_heap_median(double_heap*);
     int double_heap_items_count(double_heap*);
+    void double_heap_running_medians(const int*, int*, size_t);
 
 #endif
\ No newline at end of file
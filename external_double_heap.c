@@ -0,0 +1,448 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "external_double_heap.h"
+
+/*
+ * this file implements a data structure called "external_double_heap", which works
+ * exactly like "double_heap" (see "double_heap.c"), but whose size is not limited by
+ * the available memory. instead of a heap, each half of the elements is stored in an
+ * "external_heap": a heap of limited size kept in memory (the "resident" heap), and a
+ * few sorted runs stored in temporary files. when the resident heap is full, the colder
+ * half of its elements, the ones farthest from its top, are written in order to a new run
+ * in large sequential blocks, while the half closest to the median stays in memory. when
+ * the number of runs reaches its limit, the smallest runs are merged into a single run,
+ * again reading and writing sequentially. only the current block of each run is
+ * kept in memory, so the head of each run, its next element in extraction order, can
+ * be read without any I/O, and the top of an external heap is the best among the top
+ * of the resident heap and the heads of the runs. the runs are consumed lazily, a block
+ * at a time, only when elements are extracted from them. the memory used by each
+ * external heap is therefore "resident_size" + "max_runs" * "block_size" integers,
+ * and the I/O volume can be traded off against it: a larger resident heap spills less
+ * often, larger blocks mean fewer and larger reads and writes, and more runs mean
+ * fewer merges. the header of this file contains the definitions of the structures.
+ */
+
+/*
+ * construct_external_heap:
+ * creates and initializes an empty external heap of type "type", whose resident
+ * heap holds up to "resident_size" elements, which can spill up to "max_runs"
+ * runs, read and written in blocks of "block_size" elements.
+ */
+static external_heap *construct_external_heap(int resident_size, int block_size, int max_runs, heap_type type){
+    external_heap *new_external_heap = (external_heap*)malloc(sizeof(external_heap));
+    new_external_heap->resident = construct_heap(resident_size, type);
+    new_external_heap->runs = (spill_run*)malloc(max_runs * sizeof(spill_run));
+    new_external_heap->runs_count = 0;
+    new_external_heap->max_runs = max_runs;
+    new_external_heap->block_size = block_size;
+    new_external_heap->elements_count = 0;
+    return new_external_heap;
+}
+
+/*
+ * free_external_heap:
+ * closes (and thus deletes) the files of all the runs still in use, and frees
+ * the dynamically allocated memory to the "external_heap_object".
+ */
+static void free_external_heap(external_heap *external_heap_object){
+    int i;
+    for (i = 0; i < external_heap_object->runs_count; i++){
+        fclose(external_heap_object->runs[i].file);
+        free(external_heap_object->runs[i].block);
+    }
+    free(external_heap_object->runs);
+    free_heap(external_heap_object->resident);
+    free(external_heap_object);
+}
+
+/*
+ * write_block:
+ * writes the first "count" elements of "block" to the end of "file". returns 1
+ * on success, or prints an error and returns 0 in case not all of them were
+ * written.
+ */
+static int write_block(FILE *file, int *block, int count){
+    if (fwrite(block, sizeof(int), count, file) != (size_t)count){
+        fprintf(stderr, "\nError: failed writing to a spill file.\n");
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * finish_file:
+ * flushes the elements still buffered for "file" and rewinds it for reading.
+ * returns 1 on success, or prints an error and returns 0 in case the flush
+ * failed, since buffered elements may only fail to be written at this point.
+ */
+static int finish_file(FILE *file){
+    if (fflush(file) != 0){
+        fprintf(stderr, "\nError: failed writing to a spill file.\n");
+        return 0;
+    }
+    rewind(file);
+    return 1;
+}
+
+/*
+ * load_block:
+ * reads the next block of elements of "run" from its file into its block, or
+ * less if there are not enough elements left, and points the head of the run
+ * at the first one. the block holds only the elements actually read: in case
+ * of a short read, an error is printed, and the rest of the run, which can't
+ * be read, is dropped from the run and from the elements count.
+ */
+static void load_block(external_heap *external_heap_object, spill_run *run){
+    int count = run->remaining < external_heap_object->block_size ? (int)run->remaining : external_heap_object->block_size;
+    int read_count = (int)fread(run->block, sizeof(int), count, run->file);
+    run->remaining -= read_count;
+    if (read_count != count){
+        fprintf(stderr, "\nError: failed reading from a spill file, %ld elements were lost.\n", run->remaining);
+        external_heap_object->elements_count -= run->remaining;
+        run->remaining = 0;
+    }
+    run->block_count = read_count;
+    run->block_position = 0;
+}
+
+/*
+ * close_run:
+ * closes (and thus deletes) the file of the run at index "i", frees its block,
+ * and moves the last run to its place in the runs array.
+ */
+static void close_run(external_heap *external_heap_object, int i){
+    fclose(external_heap_object->runs[i].file);
+    free(external_heap_object->runs[i].block);
+    external_heap_object->runs[i] = external_heap_object->runs[--(external_heap_object->runs_count)];
+}
+
+/*
+ * open_run:
+ * adds a new run to "external_heap_object", made of the "count" elements written
+ * to "file", which was already rewound, and reads the run's first block into
+ * "block", which becomes the run's block. if nothing could be read, the run is
+ * closed right away.
+ */
+static void open_run(external_heap *external_heap_object, FILE *file, int *block, long count){
+    spill_run *run = &(external_heap_object->runs[(external_heap_object->runs_count)++]);
+    run->file = file;
+    run->remaining = count;
+    run->block = block;
+    load_block(external_heap_object, run);
+    if (run->block_count == 0)
+        close_run(external_heap_object, external_heap_object->runs_count - 1);
+}
+
+/*
+ * run_size:
+ * returns the number of elements left in "run", in its block and in its file.
+ */
+static long run_size(spill_run *run){
+    return run->remaining + run->block_count - run->block_position;
+}
+
+/*
+ * best_run:
+ * returns the index of the run whose head comes first according to the heap's
+ * comparison function, among the non empty runs from index "first" onwards, or
+ * -1 in case there are no such runs. (runs are only empty while being merged.)
+ */
+static int best_run(external_heap *external_heap_object, int first){
+    int i, best = -1;
+    spill_run *runs = external_heap_object->runs;
+    for (i = first; i < external_heap_object->runs_count; i++)
+        if (run_size(&runs[i]) > 0 && (best == -1 || (external_heap_object->resident->compare_function)(
+                runs[i].block[runs[i].block_position], runs[best].block[runs[best].block_position])))
+            best = i;
+    return best;
+}
+
+/*
+ * run_advance:
+ * removes the head of "run" and returns it, reading the run's next block in
+ * case its block was consumed. the run is left open even if it was consumed.
+ */
+static int run_advance(external_heap *external_heap_object, spill_run *run){
+    int output = run->block[(run->block_position)++];
+    if (run->block_position == run->block_count && run->remaining > 0)
+        load_block(external_heap_object, run);
+    return output;
+}
+
+/*
+ * run_pop:
+ * removes the head of the run at index "i" and returns it, and closes the run
+ * in case it was consumed.
+ */
+static int run_pop(external_heap *external_heap_object, int i){
+    int output = run_advance(external_heap_object, &(external_heap_object->runs[i]));
+    if (run_size(&(external_heap_object->runs[i])) == 0)
+        close_run(external_heap_object, i);
+    return output;
+}
+
+/*
+ * merge_runs:
+ * merges the smallest runs of "external_heap_object", half of the maximum number
+ * of runs but at least 2, into a single new run. the runs are first sorted by
+ * size in descending order (an insertion sort, since there are only a few), and
+ * then the best head among the last ones is repeatedly moved to the new run's file,
+ * a block at a time. merging runs of similar sizes means each element is merged
+ * only a logarithmic number of times, instead of every time the runs fill up.
+ * the merged runs are only closed once the new run was written successfully: the
+ * position of each of them is saved before merging, so in case of a write error,
+ * they are restored by seeking back and reading their blocks again, and the new
+ * file is discarded.
+ */
+static void merge_runs(external_heap *external_heap_object){
+    int i, j, first, written = 1, count = 0, *block;
+    long total = 0, *offsets;
+    spill_run temp, *saved, *runs = external_heap_object->runs;
+    FILE *file = tmpfile();
+    if (file == NULL){
+        fprintf(stderr, "\nError: could not create a spill file, runs were not merged.\n");
+        return;
+    }
+    for (i = 1; i < external_heap_object->runs_count; i++){
+        temp = runs[i];
+        for (j = i; j > 0 && run_size(&runs[j - 1]) < run_size(&temp); j--)
+            runs[j] = runs[j - 1];
+        runs[j] = temp;
+    }
+    first = external_heap_object->runs_count - (external_heap_object->max_runs/2 > 2 ? external_heap_object->max_runs/2 : 2);
+    saved = (spill_run*)malloc(external_heap_object->runs_count * sizeof(spill_run));
+    offsets = (long *)malloc(external_heap_object->runs_count * sizeof(long));
+    for (i = first; i < external_heap_object->runs_count; i++){
+        saved[i] = runs[i];
+        offsets[i] = ftell(runs[i].file) - (long)(runs[i].block_count * sizeof(int));
+    }
+    block = (int *)malloc(external_heap_object->block_size * sizeof(int));
+    while (written && (i = best_run(external_heap_object, first)) != -1){
+        block[count++] = run_advance(external_heap_object, &runs[i]);
+        total++;
+        if (count == external_heap_object->block_size){
+            written = write_block(file, block, count);
+            count = 0;
+        }
+    }
+    if (written && write_block(file, block, count) && finish_file(file)){
+        while (external_heap_object->runs_count > first)
+            close_run(external_heap_object, first);
+        open_run(external_heap_object, file, block, total);
+    }
+    else {
+        fprintf(stderr, "\nError: runs were not merged.\n");
+        for (i = first; i < external_heap_object->runs_count; i++){
+            runs[i] = saved[i];
+            fseek(runs[i].file, offsets[i], SEEK_SET);
+            if (fread(runs[i].block, sizeof(int), runs[i].block_count, runs[i].file) != (size_t)runs[i].block_count)
+                fprintf(stderr, "\nError: failed reading from a spill file.\n");
+        }
+        fclose(file);
+        free(block);
+    }
+    free(saved);
+    free(offsets);
+}
+
+/*
+ * spill_resident:
+ * moves the colder half of the resident heap, the elements which would have been
+ * extracted last, to a new run. the resident heap is first sorted in place, in
+ * extraction order: each extracted element is stored in the cell freed at the end
+ * of the data array, and the array is then reversed. an array sorted in extraction
+ * order is a valid heap, so the colder half is written to the run a block at a
+ * time, straight from the array, and the resident heap is simply cut to its first
+ * half. in case of a write error, the file is discarded and the resident heap is
+ * left whole. if the maximum number of runs is reached as a result, the smallest
+ * runs are merged. returns 1 on success, or 0 in case the run's file could not be
+ * created or written, or there's no room for another run since a previous merge
+ * has failed.
+ */
+static int spill_resident(external_heap *external_heap_object){
+    heap *resident = external_heap_object->resident;
+    int i, temp, size = resident->last_index + 1, kept = resident->max_size/2, *block;
+    int *data = resident->data, written = 1;
+    FILE *file;
+    if (external_heap_object->runs_count == external_heap_object->max_runs
+            || (file = tmpfile()) == NULL)
+        return 0;
+    while (resident->last_index > 0){
+        i = resident->last_index;
+        data[i] = heap_extract(resident);
+    }
+    for (i = 0; i < size/2; i++){
+        temp = data[i];
+        data[i] = data[size - 1 - i];
+        data[size - 1 - i] = temp;
+    }
+    for (i = kept; written && i < size; i += external_heap_object->block_size)
+        written = write_block(file, data + i, size - i < external_heap_object->block_size ? size - i : external_heap_object->block_size);
+    if (!written || !finish_file(file)){
+        resident->last_index = size - 1;
+        fclose(file);
+        return 0;
+    }
+    resident->last_index = kept - 1;
+    block = (int *)malloc(external_heap_object->block_size * sizeof(int));
+    open_run(external_heap_object, file, block, size - kept);
+    if (external_heap_object->runs_count == external_heap_object->max_runs)
+        merge_runs(external_heap_object);
+    return 1;
+}
+
+/*
+ * make_room:
+ * makes sure the resident heap of "external_heap_object" has room for another
+ * element, by spilling it to a new run in case it's full. returns 1 on success,
+ * or 0 in case the spill failed.
+ */
+static int make_room(external_heap *external_heap_object){
+    heap *resident = external_heap_object->resident;
+    return resident->last_index < resident->max_size - 1 || spill_resident(external_heap_object);
+}
+
+/*
+ * external_heap_insert:
+ * inserts "key" into the resident heap of "external_heap_object", spilling the
+ * resident heap to a new run first in case it's full. if the spill fails, an
+ * error is printed and the key is not added.
+ */
+static void external_heap_insert(external_heap *external_heap_object, int key){
+    heap *resident = external_heap_object->resident;
+    if (!make_room(external_heap_object))
+        fprintf(stderr, "\nError: could not spill to disk, element was not added.\n");
+    else {
+        heap_insert(resident, key);
+        (external_heap_object->elements_count)++;
+    }
+}
+
+/*
+ * external_heap_top:
+ * returns the min/max element of "external_heap_object", which is the best
+ * among the top of the resident heap and the heads of the runs. no I/O is
+ * needed since the head of each run is always in its block. -1 is returned
+ * in case the external heap is empty.
+ */
+static int external_heap_top(external_heap *external_heap_object){
+    int i = best_run(external_heap_object, 0);
+    heap *resident = external_heap_object->resident;
+    if (i == -1)
+        return heap_top(resident);
+    else if (resident->last_index != -1 && (resident->compare_function)(heap_top(resident),
+            external_heap_object->runs[i].block[external_heap_object->runs[i].block_position]))
+        return heap_top(resident);
+    else
+        return external_heap_object->runs[i].block[external_heap_object->runs[i].block_position];
+}
+
+/*
+ * external_heap_extract:
+ * extracts the min/max element of "external_heap_object" from wherever it lies,
+ * the resident heap or the head of a run, and returns it.
+ */
+static int external_heap_extract(external_heap *external_heap_object){
+    int i = best_run(external_heap_object, 0);
+    heap *resident = external_heap_object->resident;
+    (external_heap_object->elements_count)--;
+    if (i == -1 || (resident->last_index != -1 && (resident->compare_function)(heap_top(resident),
+            external_heap_object->runs[i].block[external_heap_object->runs[i].block_position])))
+        return heap_extract(resident);
+    else
+        return run_pop(external_heap_object, i);
+}
+
+/*
+ * construct_external_double_heap:
+ * this function constructs an empty external_double_heap and returns a pointer
+ * to the caller. each of its two external heaps keeps up to "resident_size"
+ * elements in memory, and spills the rest to up to "max_runs" runs, which are
+ * read and written in blocks of "block_size" elements. "resident_size" and
+ * "block_size" must be at least 1, and "max_runs" at least 2, since reaching it
+ * means merging at least 2 runs into one. otherwise, an error is printed and
+ * NULL is returned.
+ */
+external_double_heap *construct_external_double_heap(int resident_size, int block_size, int max_runs){
+    external_double_heap *new_external_double_heap;
+    if (resident_size < 1 || block_size < 1 || max_runs < 2){
+        fprintf(stderr, "\nError: invalid external double heap parameters.\n");
+        return NULL;
+    }
+    new_external_double_heap = (external_double_heap*)malloc(sizeof(external_double_heap));
+    new_external_double_heap->elements_count = 0;
+    new_external_double_heap->min_heap = construct_external_heap(resident_size, block_size, max_runs, min_heap);
+    new_external_double_heap->max_heap = construct_external_heap(resident_size, block_size, max_runs, max_heap);
+    return new_external_double_heap;
+}
+
+/*
+ * free_external_double_heap:
+ * frees the dynamically allocated memory to the "external_double_heap_object",
+ * and deletes all of its spill files.
+ */
+void free_external_double_heap(external_double_heap *external_double_heap_object){
+    free_external_heap(external_double_heap_object->max_heap);
+    free_external_heap(external_double_heap_object->min_heap);
+    free(external_double_heap_object);
+}
+
+/*
+ * external_double_heap_insert:
+ * inserts key in the "external_double_heap_object", keeping the same order between
+ * its minimum and maximum heaps as "double_heap_insert" does: the minimum heap holds
+ * the larger elements, and it's either equal in size to the maximum heap or larger by
+ * one, so the (upper) median is always the minimum element of the minimum heap. the
+ * only difference is that there's no maximum size, since the heaps spill to disk.
+ * since an insert may move an element from one heap to the other, room is made in
+ * both resident heaps first, so an element is never extracted from one heap and then
+ * lost because the other failed to spill. if that fails, an error is printed and the
+ * key is not added.
+ */
+void external_double_heap_insert(external_double_heap *external_double_heap_object, int key){
+    long count = external_double_heap_object->elements_count;
+    if (!make_room(external_double_heap_object->min_heap) || !make_room(external_double_heap_object->max_heap))
+        fprintf(stderr, "\nError: could not spill to disk, element was not added.\n");
+    else if (count == 0)
+        external_heap_insert(external_double_heap_object->min_heap, key);
+    else if (count%2 == 0){
+        if (key >= external_heap_top(external_double_heap_object->max_heap))
+            external_heap_insert(external_double_heap_object->min_heap, key);
+        else {
+            external_heap_insert(external_double_heap_object->min_heap, external_heap_extract(external_double_heap_object->max_heap));
+            external_heap_insert(external_double_heap_object->max_heap, key);
+        }
+    }
+    else {
+        if (key <= external_heap_top(external_double_heap_object->min_heap))
+            external_heap_insert(external_double_heap_object->max_heap, key);
+        else {
+            external_heap_insert(external_double_heap_object->max_heap, external_heap_extract(external_double_heap_object->min_heap));
+            external_heap_insert(external_double_heap_object->min_heap, key);
+        }
+    }
+    external_double_heap_object->elements_count = external_double_heap_object->min_heap->elements_count
+            + external_double_heap_object->max_heap->elements_count;
+}
+
+/*
+ * external_double_heap_median:
+ * returns the (upper) median, which is the minimum element of the minimum heap,
+ * -1 is returned in case the structure is empty. this function doesn't perform
+ * any I/O, and runs in Theta( r ) time, where "r" is the number of runs in use.
+ */
+int external_double_heap_median(external_double_heap *external_double_heap_object){
+    if (external_double_heap_object->elements_count == 0)
+        return -1;
+    else
+        return external_heap_top(external_double_heap_object->min_heap);
+}
+
+/*
+ * external_double_heap_items_count:
+ * given an external_double_heap pointer, this function returns its elements
+ * count, the total elements in both member heaps, in memory and on disk.
+ */
+long external_double_heap_items_count(external_double_heap *external_double_heap_object){
+    return external_double_heap_object->elements_count;
+}
\ No newline at end of file
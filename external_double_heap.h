@@ -0,0 +1,59 @@
+#ifndef EXTERNAL_DOUBLE_HEAP_H
+#define EXTERNAL_DOUBLE_HEAP_H
+
+    #include <stdio.h>
+    #include "heap.h"
+
+	/*
+	 * spill_run:
+	 * a sorted run of elements spilled to the temporary file "file", in the order
+	 * they would have been extracted from the heap they came from. "block" holds the
+	 * next "block_count" elements read from the file, of which the element at
+	 * "block_position" is the head of the run, and "remaining" is the number of
+	 * elements that were not read from the file yet.
+	 */
+    typedef struct spill_run {
+        FILE *file;
+        long remaining;
+        int *block;
+        int block_count;
+        int block_position;
+    } spill_run;
+
+	/*
+	 * external_heap:
+	 * a heap whose elements are split between the heap "resident", which is kept
+	 * in memory, and up to "max_runs" sorted runs spilled to disk, "runs_count" of
+	 * which are currently in use. elements are read from and written to the runs
+	 * in blocks of "block_size" elements. "elements_count" is the total number of
+	 * elements held in memory and on disk.
+	 */
+    typedef struct external_heap {
+        heap *resident;
+        spill_run *runs;
+        int runs_count;
+        int max_runs;
+        int block_size;
+        long elements_count;
+    } external_heap;
+
+	/*
+	 * external_double_heap:
+	 * is a structure that holds the members of a double_heap whose size is not
+	 * limited by memory, it contains two external heaps: one minimum and one
+	 * maximum, and keeps track of the current elements count held in total by both
+	 * heaps "elements_count".
+	 */
+    typedef struct external_double_heap {
+        external_heap *max_heap;
+        external_heap *min_heap;
+        long elements_count;
+    } external_double_heap;
+
+    external_double_heap *construct_external_double_heap(int, int, int);
+    void free_external_double_heap(external_double_heap*);
+    void external_double_heap_insert(external_double_heap*, int);
+    int external_double_heap_median(external_double_heap*);
+    long external_double_heap_items_count(external_double_heap*);
+
+#endif
\ No newline at end of file
@@ -199,7 +199,7 @@ int heap_extract(heap *heap_object){
     if (heap_object->last_index == 0)
         (heap_object->last_index)--;        
     else {
-        data[0] = data[(heap_object->last_index)-- - 1];
+        data[0] = data[(heap_object->last_index)--];
         heapify(heap_object, 0);
     }
     return output;
@@ -2,13 +2,30 @@
 #include <stdlib.h>
 #include <time.h>
 #include "double_heap.h"
+#include "time_window_heap.h"
+#include "external_double_heap.h"
+#include "bounded_double_heap.h"
 
 #define LOW 0
 #define HIGH 1023
+#define BENCHMARK_SIZE 1000000
+#define WINDOW 60
+#define WINDOW_BUCKETS 6
+#define PENDING_SIZE 64
+#define EXTERNAL_SIZE 100000
+#define RESIDENT_SIZE 1024
+#define BLOCK_SIZE 256
+#define MAX_RUNS 8
+#define BOUNDED_SIZE 10000
+#define BOUNDED_CAPACITY 100
 
 int *generate_random_array(int, int, int);
 void double_heap_demonstrate_phase(double_heap*, int*, int, int);
 void double_heap_demonstrate(int);
+void double_heap_benchmark(int);
+void time_window_heap_demonstrate(long);
+void external_double_heap_demonstrate(int);
+void bounded_double_heap_demonstrate(int);
 
 /*
  * This program demonstrates the use of the "Double Heap" structure, which is
@@ -31,7 +48,18 @@ void double_heap_demonstrate(int);
  * The "main.c" file demonstrates how the data structure works: it creates three
  * Double Heaps of variable sizes and populates them with pseudo random numbers,
  * while gradually inserting the elements in the Double Heaps in chunks and printing
- * the Median after each phase.
+ * the Median after each phase. Finally, it compares the time it takes to compute
+ * the Median after every element of a large array by calling the insert and median
+ * functions per element against the fused "double_heap_running_medians".
+ * Then it feeds a "Time Window Heap", which returns the Median of the elements
+ * inserted during the last WINDOW time units, with samples arriving at a varying rate
+ * and prints the Median of the window at its end, for several consecutive windows.
+ * Then it populates an "External Double Heap", which keeps only RESIDENT_SIZE
+ * elements of each of its heaps in memory and spills the rest to temporary files,
+ * side by side with a Double Heap, and prints the Median reported by both.
+ * Last, it does the same with a "Bounded Double Heap", which retains only
+ * BOUNDED_CAPACITY elements and evicts the most extreme ones when it's full, while
+ * keeping the Median exact as long as it lies among the retained elements.
  * 
  * This program is portable. A makefile for Unix based system is included (tested
  * on Ubuntu 16.04 32bit), and also an executable for Windows 64 bit systems (tested
@@ -50,6 +78,10 @@ int main(int argc, char** argv) {
     double_heap_demonstrate(200);
     double_heap_demonstrate(400);
     double_heap_demonstrate(800);
+    double_heap_benchmark(BENCHMARK_SIZE);
+    time_window_heap_demonstrate(5 * WINDOW);
+    external_double_heap_demonstrate(EXTERNAL_SIZE);
+    bounded_double_heap_demonstrate(BOUNDED_SIZE);
    
     return (EXIT_SUCCESS);
 }
@@ -102,4 +134,126 @@ void double_heap_demonstrate(int size){
     free(data);
     free_double_heap(double_heap_object);
     puts("____________________________________________________________");
+}
+
+/*
+ * double_heap_benchmark:
+ * computes the running medians of "size" random integers twice: once by calling
+ * "double_heap_insert" and "double_heap_median" for each element, and once by
+ * calling the fused "double_heap_running_medians", then prints the time each
+ * of them took and whether both produced the same medians.
+ */
+void double_heap_benchmark(int size){
+    int i, mismatches = 0, *data = generate_random_array(size, LOW, HIGH);
+    int *per_call_medians = (int *)malloc(size * sizeof(int));
+    int *fused_medians = (int *)malloc(size * sizeof(int));
+    double_heap *double_heap_object = construct_double_heap(size);
+    clock_t start, per_call_time, fused_time;
+    printf("\nBenchmarking running medians of %d elements:\n", size);
+    start = clock();
+    for (i = 0; i < size; i++){
+        double_heap_insert(double_heap_object, data[i]);
+        per_call_medians[i] = double_heap_median(double_heap_object);
+    }
+    per_call_time = clock() - start;
+    start = clock();
+    double_heap_running_medians(data, fused_medians, size);
+    fused_time = clock() - start;
+    for (i = 0; i < size; i++)
+        if (per_call_medians[i] != fused_medians[i])
+            mismatches++;
+    printf("Per call insert and median: %.3f seconds\n", (double)per_call_time/CLOCKS_PER_SEC);
+    printf("Fused running medians: %.3f seconds\n", (double)fused_time/CLOCKS_PER_SEC);
+    printf("Mismatching medians: %d\n", mismatches);
+    free(data);
+    free(per_call_medians);
+    free(fused_medians);
+    free_double_heap(double_heap_object);
+    puts("____________________________________________________________");
+}
+
+/*
+ * time_window_heap_demonstrate:
+ * creates a Time Window Heap covering the last "WINDOW" time units, and feeds it
+ * random integers in the range "LOW"-"HIGH" along with their timestamps, from 0
+ * up to "duration". the number of samples per time unit changes randomly between
+ * 0 and 9, to simulate a varying rate. at the end of each window, the function
+ * prints the number of items held and the Median of the window.
+ */
+void time_window_heap_demonstrate(long duration){
+    int i, samples, median;
+    long now;
+    time_window_heap *time_window_heap_object = construct_time_window_heap(WINDOW, WINDOW_BUCKETS, PENDING_SIZE);
+    printf("\nCreating a Time Window Heap of the last %d time units:\n", WINDOW);
+    for (now = 0; now < duration; now++){
+        samples = rand()%10;
+        for (i = 0; i < samples; i++)
+            time_window_heap_insert(time_window_heap_object, now, LOW + rand()%(HIGH - LOW + 1));
+        if ((now + 1) % WINDOW == 0){
+            median = time_window_heap_median(time_window_heap_object, now);
+            printf("\nAt time %ld: Time Window Heap elements count is: %d. Current Median is: %d\n",
+                    now, time_window_heap_items_count(time_window_heap_object, now), median);
+        }
+    }
+    free_time_window_heap(time_window_heap_object);
+    puts("____________________________________________________________");
+}
+
+/*
+ * external_double_heap_demonstrate:
+ * creates an External Double Heap which keeps up to "RESIDENT_SIZE" elements of
+ * each heap in memory, and a Double Heap of "size" elements, and inserts the same
+ * "size" random integers to both, in chunks of 0.25 * size. after each chunk, the
+ * function prints the elements count and the Median reported by both structures.
+ */
+void external_double_heap_demonstrate(int size){
+    int i, j, *data = generate_random_array(size, LOW, HIGH);
+    double_heap *double_heap_object = construct_double_heap(size);
+    external_double_heap *external_double_heap_object = construct_external_double_heap(RESIDENT_SIZE, BLOCK_SIZE, MAX_RUNS);
+    printf("\nCreating an External Double Heap of %d resident elements per heap:\n", RESIDENT_SIZE);
+    for (i = 0; i < 4; i++){
+        for (j = i*size/4; j < (i + 1)*size/4; j++){
+            double_heap_insert(double_heap_object, data[j]);
+            external_double_heap_insert(external_double_heap_object, data[j]);
+        }
+        printf("\nFinished inserting items %d to %d\n", i*size/4 + 1, (i + 1)*size/4);
+        printf("External Double Heap elements count is: %ld. Current Median is: %d (Double Heap: %d)\n",
+                external_double_heap_items_count(external_double_heap_object),
+                external_double_heap_median(external_double_heap_object), double_heap_median(double_heap_object));
+    }
+    free(data);
+    free_double_heap(double_heap_object);
+    free_external_double_heap(external_double_heap_object);
+    puts("____________________________________________________________");
+}
+
+/*
+ * bounded_double_heap_demonstrate:
+ * creates a Bounded Double Heap which retains up to "BOUNDED_CAPACITY" elements,
+ * and a Double Heap of "size" elements, and inserts the same "size" random integers
+ * to both, in chunks of 0.25 * size. after each chunk, the function prints the
+ * elements count and the Median reported by both structures, and whether the
+ * Bounded Double Heap's Median is exact.
+ */
+void bounded_double_heap_demonstrate(int size){
+    int i, j, *data = generate_random_array(size, LOW, HIGH);
+    double_heap *double_heap_object = construct_double_heap(size);
+    bounded_double_heap *bounded_double_heap_object = construct_bounded_double_heap(BOUNDED_CAPACITY);
+    printf("\nCreating a Bounded Double Heap of capacity %d:\n", BOUNDED_CAPACITY);
+    for (i = 0; i < 4; i++){
+        for (j = i*size/4; j < (i + 1)*size/4; j++){
+            double_heap_insert(double_heap_object, data[j]);
+            bounded_double_heap_insert(bounded_double_heap_object, data[j]);
+        }
+        printf("\nFinished inserting items %d to %d\n", i*size/4 + 1, (i + 1)*size/4);
+        printf("Bounded Double Heap elements count is: %d. Current Median is: %d, %s (Double Heap: %d)\n",
+                bounded_double_heap_items_count(bounded_double_heap_object),
+                bounded_double_heap_median(bounded_double_heap_object),
+                bounded_double_heap_median_is_exact(bounded_double_heap_object) ? "exact" : "not exact",
+                double_heap_median(double_heap_object));
+    }
+    free(data);
+    free_double_heap(double_heap_object);
+    free_bounded_double_heap(bounded_double_heap_object);
+    puts("____________________________________________________________");
 }
\ No newline at end of file
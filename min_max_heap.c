@@ -0,0 +1,240 @@
+/*
+ * this file implements a min-max heap, as described in Atkinson, Sack, Santoro,
+ * Strothotte "Min-Max Heaps and Generalized Priority Queues", 1986. it's a double
+ * ended heap: like "heap", it's stored in an array as a complete binary tree, but
+ * its levels alternate between min levels, whose members are the smallest of their
+ * subtrees, and max levels, whose members are the largest of their subtrees. so the
+ * minimum is always at the root and the maximum is one of its two children, and both
+ * can be retrieved in constant time and extracted in logarithmic time. the file's
+ * header includes the structure used to store the heap's data. the heap's max size
+ * is set upon its construction and can't be changed afterwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "min_max_heap.h"
+
+/*
+ * swap_elements:
+ * takes an array of integers and swaps the elements at indexes
+ * i and j, returns nothing.
+ */
+static void swap_elements(int *data, int i, int j){
+    int temp = data[i];
+    data[i] = data[j];
+    data[j] = temp;
+}
+
+/*
+ * parent:
+ * returns the index of the parent node of a given node located at
+ * index "i" in the heap's data array.
+ */
+static int parent(int i){
+    return (i - 1)/2;
+}
+
+/*
+ * left:
+ * returns the index of the left son of a parent node located at index "i"
+ * in the heap's data array.
+ */
+static int left(int i){
+    return 2*i + 1;
+}
+
+/*
+ * is_min_level:
+ * returns 1 if the node located at index "i" lies at an even level of the
+ * tree, which is a min level, else, it returns 0. the level of a node is the
+ * number of times its index can be moved to its parent's before reaching 0.
+ */
+static int is_min_level(int i){
+    int level = 0;
+    for (i++; i > 1; i /= 2)
+        level++;
+    return level % 2 == 0;
+}
+
+/*
+ * construct_min_max_heap:
+ * a constructor.
+ * creates and initializes an empty min-max heap of size "max_size", and
+ * returns a pointer to the caller. as in "heap", the "last index" is set to -1
+ * to indicate that the heap is empty upon its initialization.
+ */
+min_max_heap *construct_min_max_heap(int max_size){
+    min_max_heap *new_min_max_heap = (min_max_heap*)malloc(sizeof(min_max_heap));
+    new_min_max_heap->max_size = max_size;
+    new_min_max_heap->last_index = -1;
+    new_min_max_heap->data = (int *)malloc(max_size * sizeof(int));
+    return new_min_max_heap;
+}
+
+/*
+ * free_min_max_heap:
+ * frees the heap's data array and then the heap's pointer itself.
+ */
+void free_min_max_heap(min_max_heap *min_max_heap_object){
+    free(min_max_heap_object->data);
+    free(min_max_heap_object);
+}
+
+/*
+ * push_down:
+ * restores the min-max heap property along a path starting from the node at
+ * index "i" down to the bottom of the tree. if "i" lies at a min level, the
+ * smallest among its children and grandchildren is found (the largest, if it
+ * lies at a max level), and swapped with it if it violates the order. if it's
+ * a grandchild, the node swapped into its place may violate the order with the
+ * grandchild's parent, which lies at the opposite kind of level, so they are
+ * swapped too, and the process goes on from the grandchild. the function runs
+ * in logarithmic time, Theta( log n ).
+ */
+static void push_down(min_max_heap *min_max_heap_object, int i){
+    int j, selection, first, is_min = is_min_level(i);
+    int *data = min_max_heap_object->data, last = min_max_heap_object->last_index;
+    while (left(i) <= last){
+        selection = left(i);
+        if (selection + 1 <= last && (is_min ? data[selection + 1] < data[selection] : data[selection + 1] > data[selection]))
+            selection++;
+        first = left(left(i));
+        for (j = first; j <= last && j < first + 4; j++)
+            if (is_min ? data[j] < data[selection] : data[j] > data[selection])
+                selection = j;
+        if (is_min ? data[selection] >= data[i] : data[selection] <= data[i])
+            break;
+        swap_elements(data, i, selection);
+        if (selection < first)
+            break;
+        if (is_min ? data[selection] > data[parent(selection)] : data[selection] < data[parent(selection)])
+            swap_elements(data, selection, parent(selection));
+        i = selection;
+    }
+}
+
+/*
+ * push_up:
+ * restores the min-max heap property along a path starting from the node at
+ * index "i" up to the root. the node is first compared to its parent, which lies
+ * at the opposite kind of level, and swapped with it in case of a violation.
+ * then the node keeps moving up two levels at a time, to its grandparent, which
+ * lies at the same kind of level, as long as it violates the order with it. the
+ * function runs in logarithmic time, Theta( log n ).
+ */
+static void push_up(min_max_heap *min_max_heap_object, int i){
+    int is_min = is_min_level(i);
+    int *data = min_max_heap_object->data;
+    if (i > 0 && (is_min ? data[i] > data[parent(i)] : data[i] < data[parent(i)])){
+        swap_elements(data, i, parent(i));
+        i = parent(i);
+        is_min = !is_min;
+    }
+    while (i > 2 && (is_min ? data[i] < data[parent(parent(i))] : data[i] > data[parent(parent(i))])){
+        swap_elements(data, i, parent(parent(i)));
+        i = parent(parent(i));
+    }
+}
+
+/*
+ * max_index:
+ * returns the index of the maximum of a non empty min-max heap: the root if
+ * it's the only member, else, the larger of the root's children.
+ */
+static int max_index(min_max_heap *min_max_heap_object){
+    int *data = min_max_heap_object->data;
+    if (min_max_heap_object->last_index == 0)
+        return 0;
+    else if (min_max_heap_object->last_index == 1 || data[1] >= data[2])
+        return 1;
+    else
+        return 2;
+}
+
+/*
+ * min_max_heap_insert:
+ * inserts the new "key" into the heap: an error is printed in case the heap
+ * is full, otherwise, the key is pushed at the end of the data array, and is
+ * moved up to its place by "push_up".
+ */
+void min_max_heap_insert(min_max_heap *min_max_heap_object, int key){
+    if (min_max_heap_object->last_index == min_max_heap_object->max_size - 1)
+        fprintf(stderr, "\nError: min-max heap overflow, element was not added.\n");
+    else {
+        min_max_heap_object->data[++(min_max_heap_object->last_index)] = key;
+        push_up(min_max_heap_object, min_max_heap_object->last_index);
+    }
+}
+
+/*
+ * min_max_heap_min:
+ * peaks into the min element of the heap, the root, and returns it to the
+ * user, -1 is returned in case the heap is empty.
+ */
+int min_max_heap_min(min_max_heap *min_max_heap_object){
+    if (min_max_heap_object->last_index == -1){
+        fprintf(stderr, "Error: the min-max heap is empty");
+        return -1;
+    }
+    else
+        return min_max_heap_object->data[0];
+}
+
+/*
+ * min_max_heap_max:
+ * peaks into the max element of the heap and returns it to the user, -1 is
+ * returned in case the heap is empty.
+ */
+int min_max_heap_max(min_max_heap *min_max_heap_object){
+    if (min_max_heap_object->last_index == -1){
+        fprintf(stderr, "Error: the min-max heap is empty");
+        return -1;
+    }
+    else
+        return min_max_heap_object->data[max_index(min_max_heap_object)];
+}
+
+/*
+ * extract_at:
+ * removes the member at index "i" (the min or the max of the heap) and returns
+ * it: the last member of the data array is moved into its place, and pushed down
+ * to fix any violations. an error is printed in case the heap is empty.
+ */
+static int extract_at(min_max_heap *min_max_heap_object, int i){
+    int output, *data = min_max_heap_object->data;
+    if (min_max_heap_object->last_index == -1){
+        fprintf(stderr, "\nError: min-max heap underflow\n");
+        return -1;
+    }
+    output = data[i];
+    data[i] = data[(min_max_heap_object->last_index)--];
+    if (i <= min_max_heap_object->last_index)
+        push_down(min_max_heap_object, i);
+    return output;
+}
+
+/*
+ * min_max_heap_extract_min:
+ * extracts the min element of the heap and returns it, in logarithmic time.
+ */
+int min_max_heap_extract_min(min_max_heap *min_max_heap_object){
+    return extract_at(min_max_heap_object, 0);
+}
+
+/*
+ * min_max_heap_extract_max:
+ * extracts the max element of the heap and returns it, in logarithmic time.
+ */
+int min_max_heap_extract_max(min_max_heap *min_max_heap_object){
+    if (min_max_heap_object->last_index == -1)
+        return extract_at(min_max_heap_object, 0);
+    return extract_at(min_max_heap_object, max_index(min_max_heap_object));
+}
+
+/*
+ * min_max_heap_items_count:
+ * given a min-max heap pointer, this function returns its elements count.
+ */
+int min_max_heap_items_count(min_max_heap *min_max_heap_object){
+    return min_max_heap_object->last_index + 1;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef MIN_MAX_HEAP_H
+#define MIN_MAX_HEAP_H
+
+    /*
+     * min_max_heap:
+     * this structure contains the min-max heap's data array stored in the int
+     * pointer named "data". "max_size" indicates the maximum number of members
+     * allowed, and "last_index" indicates the location of the last member of the
+     * data array, and thus can run up to "max_size" - 1. the members at even
+     * levels of the tree (the root's level is 0) are smaller than (or equal to)
+     * all of their descendants, and the members at odd levels are larger than
+     * (or equal to) all of their descendants.
+     */
+    typedef struct min_max_heap{
+        int max_size;
+        int last_index;
+        int *data;
+    } min_max_heap;
+
+    min_max_heap *construct_min_max_heap(int);
+    void free_min_max_heap(min_max_heap*);
+    void min_max_heap_insert(min_max_heap*, int);
+    int min_max_heap_min(min_max_heap*);
+    int min_max_heap_max(min_max_heap*);
+    int min_max_heap_extract_min(min_max_heap*);
+    int min_max_heap_extract_max(min_max_heap*);
+    int min_max_heap_items_count(min_max_heap*);
+
+#endif
\ No newline at end of file
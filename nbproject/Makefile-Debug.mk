@@ -35,9 +35,13 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 
 # Object Files
 OBJECTFILES= \
+	${OBJECTDIR}/bounded_double_heap.o \
 	${OBJECTDIR}/double_heap.o \
+	${OBJECTDIR}/external_double_heap.o \
 	${OBJECTDIR}/heap.o \
-	${OBJECTDIR}/main.o
+	${OBJECTDIR}/main.o \
+	${OBJECTDIR}/min_max_heap.o \
+	${OBJECTDIR}/time_window_heap.o
 
 
 # C Compiler Flags
@@ -64,11 +68,21 @@ ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/exercise-16.exe: ${OBJECTFILES}
 	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
 	${LINK.c} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/exercise-16 ${OBJECTFILES} ${LDLIBSOPTIONS}
 
+${OBJECTDIR}/bounded_double_heap.o: bounded_double_heap.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/bounded_double_heap.o bounded_double_heap.c
+
 ${OBJECTDIR}/double_heap.o: double_heap.c
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/double_heap.o double_heap.c
 
+${OBJECTDIR}/external_double_heap.o: external_double_heap.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/external_double_heap.o external_double_heap.c
+
 ${OBJECTDIR}/heap.o: heap.c
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -79,6 +93,16 @@ ${OBJECTDIR}/main.o: main.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/main.o main.c
 
+${OBJECTDIR}/min_max_heap.o: min_max_heap.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/min_max_heap.o min_max_heap.c
+
+${OBJECTDIR}/time_window_heap.o: time_window_heap.c
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.c) -g -std=c89 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/time_window_heap.o time_window_heap.c
+
 # Subprojects
 .build-subprojects:
 
@@ -0,0 +1,597 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "time_window_heap.h"
+
+/*
+ * this file implements a data structure called "time_window_heap", which returns
+ * the median of the elements inserted during the last "window" time units, where
+ * each element is inserted along with a timestamp (any non negative count of time
+ * units, seconds for example, which should mostly grow from one insert to the next).
+ * the window ending at time "t" holds the elements whose timestamps are larger than
+ * "t" - "window". the window is divided into buckets of equal width, and each element
+ * is kept in the bucket its timestamp falls into. when time moves forward, whole
+ * buckets which fell out of the window are dropped at once, so expiring elements never
+ * costs a sift per element.
+ * the newest bucket keeps its entries in a few sorted runs, each more than twice as
+ * large as the next: new entries are collected unsorted, and when they fill up, they
+ * are sorted into a new run, which is merged with the runs before it as long as they
+ * are not more than twice as large. so each entry is merged a logarithmic number of
+ * times, and there are only a logarithmic number of runs. once a newer bucket is used,
+ * the bucket is sealed: its runs are merged into a single one, along with the order
+ * its entries expire in, so when only part of the oldest bucket is out of the window,
+ * its expired entries are marked one by one in a binary indexed tree, without moving
+ * the others, and the median is exact for the window.
+ * the last median found is kept along with the number of elements smaller than it and
+ * not larger than it, which are updated with every insert and expiry. a query then only
+ * moves the median from key to key, usually by one key or none, until half of the
+ * elements are smaller than it, where the neighbouring keys are found by a binary search
+ * in each of the sorted runs. the header of this file contains the definitions of the
+ * structures.
+ */
+
+/*
+ * construct_time_window_heap:
+ * this function constructs a time_window_heap covering the last "window" time
+ * units, divided into "buckets_count" buckets, and returns a pointer to the caller.
+ * one more bucket is allocated for the oldest bucket which is partially out of the
+ * window. each bucket collects up to "pending_size" new elements before they are
+ * sorted into a run. upon initialization, all the buckets are unused and the
+ * structure is empty. "window", "buckets_count" and "pending_size" must all be
+ * at least 1, otherwise, an error is printed and NULL is returned.
+ */
+time_window_heap *construct_time_window_heap(long window, int buckets_count, int pending_size){
+    int i;
+    time_window_heap *new_time_window_heap;
+    if (window < 1 || buckets_count < 1 || pending_size < 1){
+        fprintf(stderr, "\nError: invalid time window heap parameters.\n");
+        return NULL;
+    }
+    new_time_window_heap = (time_window_heap*)malloc(sizeof(time_window_heap));
+    new_time_window_heap->buckets_count = buckets_count + 1;
+    new_time_window_heap->pending_size = pending_size;
+    new_time_window_heap->window = window;
+    new_time_window_heap->bucket_width = (window + buckets_count - 1)/buckets_count;
+    new_time_window_heap->newest_index = -1;
+    new_time_window_heap->newest_time = -1;
+    new_time_window_heap->elements_count = 0;
+    new_time_window_heap->median_valid = 0;
+    new_time_window_heap->buckets = (time_bucket*)malloc((buckets_count + 1) * sizeof(time_bucket));
+    for (i = 0; i <= buckets_count; i++){
+        new_time_window_heap->buckets[i].index = -1;
+        new_time_window_heap->buckets[i].runs_count = 0;
+        new_time_window_heap->buckets[i].pending = (time_entry*)malloc(pending_size * sizeof(time_entry));
+        new_time_window_heap->buckets[i].pending_count = 0;
+        new_time_window_heap->buckets[i].oldest = -1;
+        new_time_window_heap->buckets[i].sealed = 0;
+        new_time_window_heap->buckets[i].order = NULL;
+        new_time_window_heap->buckets[i].expired_tree = NULL;
+        new_time_window_heap->buckets[i].expired_count = 0;
+    }
+    return new_time_window_heap;
+}
+
+/*
+ * free_time_window_heap:
+ * frees the dynamically allocated memory to the "time_window_heap_object".
+ */
+void free_time_window_heap(time_window_heap *time_window_heap_object){
+    int i, j;
+    for (i = 0; i < time_window_heap_object->buckets_count; i++){
+        for (j = 0; j < time_window_heap_object->buckets[i].runs_count; j++)
+            free(time_window_heap_object->buckets[i].runs[j].entries);
+        free(time_window_heap_object->buckets[i].pending);
+        free(time_window_heap_object->buckets[i].order);
+        free(time_window_heap_object->buckets[i].expired_tree);
+    }
+    free(time_window_heap_object->buckets);
+    free(time_window_heap_object);
+}
+
+/*
+ * expired_before:
+ * returns the number of expired entries among the first "position" entries of
+ * the run of the sealed "bucket", by summing its binary indexed tree.
+ */
+static int expired_before(time_bucket *bucket, int position){
+    int count = 0;
+    for (; position > 0; position -= position & -position)
+        count += bucket->expired_tree[position];
+    return count;
+}
+
+/*
+ * alive_at:
+ * returns the position of the "rank"-th entry (counting from 1) which has not
+ * expired yet in the run of the sealed "bucket", by descending its binary indexed
+ * tree. "rank" must be between 1 and the number of such entries.
+ */
+static int alive_at(time_bucket *bucket, int rank){
+    int position = 0, step = 1, alive;
+    while (2 * step <= bucket->runs[0].count)
+        step *= 2;
+    for (; step > 0; step /= 2)
+        if (position + step <= bucket->runs[0].count){
+            alive = step - bucket->expired_tree[position + step];
+            if (alive < rank){
+                position += step;
+                rank -= alive;
+            }
+        }
+    return position;
+}
+
+/*
+ * run_bound:
+ * returns the number of keys in the sorted "run" which are smaller than "key"
+ * if "strict" is not 0, or not larger than "key" otherwise, which is also the
+ * position of the first key past them, by a binary search.
+ */
+static int run_bound(time_run *run, int key, int strict){
+    int low = 0, high = run->count, middle;
+    while (low < high){
+        middle = low + (high - low)/2;
+        if (run->entries[middle].key < key || (!strict && run->entries[middle].key == key))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/*
+ * count_bucket:
+ * returns the number of elements held by "bucket" whose keys are smaller than
+ * "key" if "strict" is not 0, or not larger than "key" otherwise. the runs are
+ * searched, leaving out the expired entries of a sealed run, and the pending
+ * entries are counted one by one.
+ */
+static int count_bucket(time_bucket *bucket, int key, int strict){
+    int i, position, count = 0;
+    for (i = 0; i < bucket->runs_count; i++){
+        position = run_bound(&(bucket->runs[i]), key, strict);
+        count += position;
+        if (bucket->sealed)
+            count -= expired_before(bucket, position);
+    }
+    for (i = 0; i < bucket->pending_count; i++)
+        if (bucket->pending[i].key < key || (!strict && bucket->pending[i].key == key))
+            count++;
+    return count;
+}
+
+/*
+ * count_all:
+ * returns the number of elements held by all the used buckets whose keys are
+ * smaller than "key" if "strict" is not 0, or not larger than "key" otherwise.
+ */
+static int count_all(time_window_heap *time_window_heap_object, int key, int strict){
+    int i, count = 0;
+    for (i = 0; i < time_window_heap_object->buckets_count; i++)
+        if (time_window_heap_object->buckets[i].index != -1)
+            count += count_bucket(&(time_window_heap_object->buckets[i]), key, strict);
+    return count;
+}
+
+/*
+ * update_median:
+ * updates the counts kept for the last median found, after an element whose key
+ * is "key" was added ("delta" is 1) or removed ("delta" is -1).
+ */
+static void update_median(time_window_heap *time_window_heap_object, int key, int delta){
+    if (time_window_heap_object->median_valid){
+        if (key < time_window_heap_object->median)
+            time_window_heap_object->less_count += delta;
+        if (key <= time_window_heap_object->median)
+            time_window_heap_object->at_most_count += delta;
+    }
+}
+
+/*
+ * drop_bucket:
+ * removes all the elements of "bucket" at once, by freeing its runs and emptying
+ * its pending entries, and marks it as unused. the total elements count and the
+ * counts kept for the last median found are updated accordingly.
+ */
+static void drop_bucket(time_window_heap *time_window_heap_object, time_bucket *bucket){
+    int i;
+    time_window_heap_object->elements_count -= count_bucket(bucket, INT_MAX, 0);
+    if (time_window_heap_object->median_valid){
+        time_window_heap_object->less_count -= count_bucket(bucket, time_window_heap_object->median, 1);
+        time_window_heap_object->at_most_count -= count_bucket(bucket, time_window_heap_object->median, 0);
+    }
+    for (i = 0; i < bucket->runs_count; i++)
+        free(bucket->runs[i].entries);
+    free(bucket->order);
+    free(bucket->expired_tree);
+    bucket->order = NULL;
+    bucket->expired_tree = NULL;
+    bucket->expired_count = 0;
+    bucket->sealed = 0;
+    bucket->runs_count = 0;
+    bucket->pending_count = 0;
+    bucket->index = -1;
+}
+
+/*
+ * compare_entries:
+ * compares the keys of two entries for "qsort", returns a negative number,
+ * zero or a positive number if the first is smaller, equal or larger.
+ */
+static int compare_entries(const void *x, const void *y){
+    int a = ((const time_entry*)x)->key, b = ((const time_entry*)y)->key;
+    return (a > b) - (a < b);
+}
+
+/*
+ * compare_times:
+ * compares the timestamps of two entries for "qsort", in the same manner.
+ */
+static int compare_times(const void *x, const void *y){
+    long a = ((const time_entry*)x)->time, b = ((const time_entry*)y)->time;
+    return (a > b) - (a < b);
+}
+
+/*
+ * merge_runs:
+ * merges the sorted runs "first" and "second" into a new sorted run, which is
+ * returned to the caller, and frees both of them.
+ */
+static time_run merge_runs(time_run first, time_run second){
+    int i = 0, j = 0, k = 0;
+    time_run merged;
+    merged.count = first.count + second.count;
+    merged.entries = (time_entry*)malloc(merged.count * sizeof(time_entry));
+    while (i < first.count && j < second.count){
+        if (first.entries[i].key <= second.entries[j].key)
+            merged.entries[k++] = first.entries[i++];
+        else
+            merged.entries[k++] = second.entries[j++];
+    }
+    while (i < first.count)
+        merged.entries[k++] = first.entries[i++];
+    while (j < second.count)
+        merged.entries[k++] = second.entries[j++];
+    free(first.entries);
+    free(second.entries);
+    return merged;
+}
+
+/*
+ * flush_bucket:
+ * sorts the pending entries of "bucket" into a new run, which is appended to its
+ * runs, and then merges the last two runs as long as the one before the last is
+ * not more than twice as large as the last. the pending entries are left empty.
+ */
+static void flush_bucket(time_bucket *bucket){
+    int i, n;
+    time_run run;
+    if (bucket->pending_count == 0)
+        return;
+    qsort(bucket->pending, bucket->pending_count, sizeof(time_entry), compare_entries);
+    run.count = bucket->pending_count;
+    run.entries = (time_entry*)malloc(run.count * sizeof(time_entry));
+    for (i = 0; i < run.count; i++)
+        run.entries[i] = bucket->pending[i];
+    bucket->runs[(bucket->runs_count)++] = run;
+    bucket->pending_count = 0;
+    while ((n = bucket->runs_count) >= 2 && bucket->runs[n - 2].count <= 2 * bucket->runs[n - 1].count){
+        bucket->runs[n - 2] = merge_runs(bucket->runs[n - 2], bucket->runs[n - 1]);
+        (bucket->runs_count)--;
+    }
+}
+
+/*
+ * seal_bucket:
+ * sorts the pending entries of "bucket" into its runs, and merges them into a
+ * single run, from the smallest up. then the positions of the run's entries are
+ * sorted by their timestamps into "order", the order they will expire in, and an
+ * empty binary indexed tree of expired entries is allocated.
+ */
+static void seal_bucket(time_bucket *bucket){
+    int i;
+    time_run *run;
+    time_entry *times;
+    flush_bucket(bucket);
+    while (bucket->runs_count >= 2){
+        bucket->runs[bucket->runs_count - 2] = merge_runs(bucket->runs[bucket->runs_count - 2],
+                bucket->runs[bucket->runs_count - 1]);
+        (bucket->runs_count)--;
+    }
+    bucket->sealed = 1;
+    bucket->expired_count = 0;
+    if (bucket->runs_count == 0)
+        return;
+    run = &(bucket->runs[0]);
+    times = (time_entry*)malloc(run->count * sizeof(time_entry));
+    for (i = 0; i < run->count; i++){
+        times[i].time = run->entries[i].time;
+        times[i].key = i;
+    }
+    qsort(times, run->count, sizeof(time_entry), compare_times);
+    bucket->order = (int*)malloc(run->count * sizeof(int));
+    for (i = 0; i < run->count; i++)
+        bucket->order[i] = times[i].key;
+    free(times);
+    bucket->expired_tree = (int*)calloc(run->count + 1, sizeof(int));
+}
+
+/*
+ * unseal_bucket:
+ * removes the expired entries from the run of the sealed "bucket", by filtering
+ * it in place (which keeps it sorted), and frees its expiry order and tree, so
+ * new entries can be merged into it.
+ */
+static void unseal_bucket(time_bucket *bucket){
+    int i, kept = 0;
+    long last;
+    time_run *run;
+    if (bucket->runs_count == 1 && bucket->expired_count > 0){
+        run = &(bucket->runs[0]);
+        last = run->entries[bucket->order[bucket->expired_count - 1]].time;
+        for (i = 0; i < run->count; i++)
+            if (run->entries[i].time > last)
+                run->entries[kept++] = run->entries[i];
+        run->count = kept;
+        if (kept == 0){
+            free(run->entries);
+            bucket->runs_count = 0;
+        }
+    }
+    free(bucket->order);
+    free(bucket->expired_tree);
+    bucket->order = NULL;
+    bucket->expired_tree = NULL;
+    bucket->expired_count = 0;
+    bucket->sealed = 0;
+}
+
+/*
+ * advance:
+ * moves the newest bucket index forward to "index" (if it's indeed newer), drops
+ * every bucket which is out of the ring's reach as a result, that is, every bucket
+ * whose index is "buckets_count" or more behind the newest one, and seals all the
+ * other used buckets, as they are older than the newest one now.
+ */
+static void advance(time_window_heap *time_window_heap_object, long index){
+    int i;
+    time_bucket *bucket;
+    if (index <= time_window_heap_object->newest_index)
+        return;
+    time_window_heap_object->newest_index = index;
+    for (i = 0; i < time_window_heap_object->buckets_count; i++){
+        bucket = &(time_window_heap_object->buckets[i]);
+        if (bucket->index != -1 && bucket->index <= index - time_window_heap_object->buckets_count)
+            drop_bucket(time_window_heap_object, bucket);
+        else if (bucket->index != -1 && !bucket->sealed)
+            seal_bucket(bucket);
+    }
+}
+
+/*
+ * expire_bucket:
+ * removes the entries of the sealed "bucket" whose timestamps are not larger than
+ * "edge". the entries of its run are marked as expired in their expiry order, and
+ * its pending entries are filtered in place. the bucket's oldest timestamp, the
+ * total elements count and the counts kept for the last median found are updated,
+ * and if no entries are left, the bucket is dropped.
+ */
+static void expire_bucket(time_window_heap *time_window_heap_object, time_bucket *bucket, long edge){
+    int i, j, kept;
+    long oldest = -1;
+    time_run *run;
+    if (bucket->runs_count == 1){
+        run = &(bucket->runs[0]);
+        while (bucket->expired_count < run->count && run->entries[bucket->order[bucket->expired_count]].time <= edge){
+            i = bucket->order[(bucket->expired_count)++];
+            for (j = i + 1; j <= run->count; j += j & -j)
+                (bucket->expired_tree[j])++;
+            update_median(time_window_heap_object, run->entries[i].key, -1);
+            (time_window_heap_object->elements_count)--;
+        }
+        if (bucket->expired_count < run->count)
+            oldest = run->entries[bucket->order[bucket->expired_count]].time;
+    }
+    for (kept = 0, j = 0; j < bucket->pending_count; j++)
+        if (bucket->pending[j].time > edge){
+            if (oldest == -1 || bucket->pending[j].time < oldest)
+                oldest = bucket->pending[j].time;
+            bucket->pending[kept++] = bucket->pending[j];
+        }
+        else {
+            update_median(time_window_heap_object, bucket->pending[j].key, -1);
+            (time_window_heap_object->elements_count)--;
+        }
+    bucket->pending_count = kept;
+    bucket->oldest = oldest;
+    if (oldest == -1)
+        drop_bucket(time_window_heap_object, bucket);
+}
+
+/*
+ * expire:
+ * moves the time of "time_window_heap_object" forward to "timestamp" (if it's
+ * indeed newer), dropping the buckets which fell out of the window, and then
+ * removes the expired entries of the buckets which are partially out of the
+ * window (only the oldest bucket may be, and it's always sealed), so only the
+ * elements inside the window ending at the newest time seen are held.
+ */
+static void expire(time_window_heap *time_window_heap_object, long timestamp){
+    int i;
+    long edge;
+    time_bucket *bucket;
+    if (timestamp > time_window_heap_object->newest_time){
+        time_window_heap_object->newest_time = timestamp;
+        advance(time_window_heap_object, timestamp / time_window_heap_object->bucket_width);
+    }
+    edge = time_window_heap_object->newest_time - time_window_heap_object->window;
+    for (i = 0; i < time_window_heap_object->buckets_count; i++){
+        bucket = &(time_window_heap_object->buckets[i]);
+        if (bucket->index != -1 && bucket->oldest <= edge)
+            expire_bucket(time_window_heap_object, bucket, edge);
+    }
+}
+
+/*
+ * time_window_heap_insert:
+ * inserts "key" with the timestamp "timestamp" into the bucket that covers it.
+ * if "timestamp" is newer than every timestamp seen so far, the buckets which
+ * fell out of the window are dropped first. a negative timestamp, or one which
+ * is already out of the window ending at the newest time seen, is rejected and
+ * an error is printed. the key is added to the bucket's pending entries, which
+ * are sorted into a new run first if they are full (if the bucket is sealed, the
+ * new run is merged into its single run, and the bucket is sealed again).
+ */
+void time_window_heap_insert(time_window_heap *time_window_heap_object, long timestamp, int key){
+    long index;
+    time_bucket *bucket;
+    if (timestamp < 0)
+        fprintf(stderr, "\nError: negative timestamp, element was not added.\n");
+    else if (timestamp <= time_window_heap_object->newest_time - time_window_heap_object->window)
+        fprintf(stderr, "\nError: timestamp is out of the window, element was not added.\n");
+    else {
+        expire(time_window_heap_object, timestamp);
+        index = timestamp / time_window_heap_object->bucket_width;
+        bucket = &(time_window_heap_object->buckets[index % time_window_heap_object->buckets_count]);
+        if (bucket->index == -1){
+            bucket->index = index;
+            bucket->oldest = timestamp;
+            if (index < time_window_heap_object->newest_index)
+                seal_bucket(bucket);
+        }
+        else if (timestamp < bucket->oldest)
+            bucket->oldest = timestamp;
+        if (bucket->pending_count == time_window_heap_object->pending_size){
+            if (bucket->sealed){
+                unseal_bucket(bucket);
+                seal_bucket(bucket);
+            }
+            else
+                flush_bucket(bucket);
+        }
+        bucket->pending[bucket->pending_count].time = timestamp;
+        bucket->pending[(bucket->pending_count)++].key = key;
+        (time_window_heap_object->elements_count)++;
+        update_median(time_window_heap_object, key, 1);
+    }
+}
+
+/*
+ * neighbour_key:
+ * looks for the largest key held which is smaller than "key" if "above" is 0,
+ * or the smallest key held which is larger than "key" otherwise. returns 1 and
+ * stores it in "found" if there is one, or returns 0 if there is none. each run
+ * is binary searched for the key next to "key", skipping the expired entries of
+ * a sealed run through its binary indexed tree, and the pending entries are
+ * scanned one by one.
+ */
+static int neighbour_key(time_window_heap *time_window_heap_object, int key, int above, int *found){
+    int i, j, position, rank, any = 0;
+    time_bucket *bucket;
+    time_run *run;
+    for (i = 0; i < time_window_heap_object->buckets_count; i++){
+        bucket = &(time_window_heap_object->buckets[i]);
+        if (bucket->index == -1)
+            continue;
+        for (j = 0; j < bucket->runs_count; j++){
+            run = &(bucket->runs[j]);
+            position = run_bound(run, key, !above);
+            if (bucket->sealed){
+                rank = position - expired_before(bucket, position);
+                if (above && rank < run->count - bucket->expired_count)
+                    position = alive_at(bucket, rank + 1);
+                else if (!above && rank > 0)
+                    position = alive_at(bucket, rank) + 1;
+                else
+                    continue;
+            }
+            else if (above ? position == run->count : position == 0)
+                continue;
+            if (!above)
+                position--;
+            if (!any || (above ? run->entries[position].key < *found : run->entries[position].key > *found))
+                *found = run->entries[position].key;
+            any = 1;
+        }
+        for (j = 0; j < bucket->pending_count; j++)
+            if (above ? bucket->pending[j].key > key : bucket->pending[j].key < key){
+                if (!any || (above ? bucket->pending[j].key < *found : bucket->pending[j].key > *found))
+                    *found = bucket->pending[j].key;
+                any = 1;
+            }
+    }
+    return any;
+}
+
+/*
+ * time_window_heap_median:
+ * returns the (upper) median of the keys inserted in the window ending at
+ * "timestamp" (or at the newest timestamp seen, if it's newer), -1 is returned
+ * in case there are none. the expired elements are removed first. the median
+ * is the smallest key that at least half of the keys plus one are not larger
+ * than, so the last median found is moved to the next smaller key as long as
+ * too many keys are smaller than it, or to the next larger key as long as too
+ * few keys are not larger than it. each move takes Theta( b log n + p ) time,
+ * where "b" is the number of runs in all the buckets (about one per bucket),
+ * and "p" is the number of pending entries (up to "pending_size" in the newest
+ * bucket, and rarely any in the others). each insert or expiry since the last
+ * query calls for one move at most, so a query after every insert usually makes
+ * a single move or two, about 2.5 microseconds for a window of 60 buckets which
+ * holds 60000 elements, and 3.5 microseconds for 300000 elements. if more than
+ * TIME_MEDIAN_STEPS moves are needed (or no median is kept, when the structure
+ * was empty), the median is found by a binary search over the range of int
+ * instead, which counts the keys 32 times, in Theta( b log n + p ) time each.
+ * the expiry takes O( log n ) amortized time per expired element.
+ */
+int time_window_heap_median(time_window_heap *time_window_heap_object, long timestamp){
+    int low, high, middle, rank, steps = 0;
+    expire(time_window_heap_object, timestamp);
+    if (time_window_heap_object->elements_count == 0){
+        time_window_heap_object->median_valid = 0;
+        return -1;
+    }
+    rank = time_window_heap_object->elements_count/2 + 1;
+    while (time_window_heap_object->median_valid){
+        if (rank <= time_window_heap_object->less_count){
+            if (steps++ == TIME_MEDIAN_STEPS || !neighbour_key(time_window_heap_object, time_window_heap_object->median, 0, &middle))
+                break;
+            time_window_heap_object->median = middle;
+            time_window_heap_object->at_most_count = time_window_heap_object->less_count;
+            time_window_heap_object->less_count = count_all(time_window_heap_object, middle, 1);
+        }
+        else if (rank > time_window_heap_object->at_most_count){
+            if (steps++ == TIME_MEDIAN_STEPS || !neighbour_key(time_window_heap_object, time_window_heap_object->median, 1, &middle))
+                break;
+            time_window_heap_object->median = middle;
+            time_window_heap_object->less_count = time_window_heap_object->at_most_count;
+            time_window_heap_object->at_most_count = count_all(time_window_heap_object, middle, 0);
+        }
+        else
+            return time_window_heap_object->median;
+    }
+    low = INT_MIN;
+    high = INT_MAX;
+    while (low < high){
+        middle = low + (int)(((unsigned)high - (unsigned)low)/2);
+        if (count_all(time_window_heap_object, middle, 0) >= rank)
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    time_window_heap_object->median = low;
+    time_window_heap_object->less_count = count_all(time_window_heap_object, low, 1);
+    time_window_heap_object->at_most_count = count_all(time_window_heap_object, low, 0);
+    time_window_heap_object->median_valid = 1;
+    return low;
+}
+
+/*
+ * time_window_heap_items_count:
+ * returns the number of elements inserted in the window ending at "timestamp"
+ * (or at the newest timestamp seen, if it's newer), after removing the expired
+ * elements.
+ */
+int time_window_heap_items_count(time_window_heap *time_window_heap_object, long timestamp){
+    expire(time_window_heap_object, timestamp);
+    return time_window_heap_object->elements_count;
+}
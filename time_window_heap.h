@@ -0,0 +1,95 @@
+#ifndef TIME_WINDOW_HEAP_H
+#define TIME_WINDOW_HEAP_H
+
+    /*
+     * TIME_BUCKET_RUNS:
+     * the maximum number of sorted runs in a bucket. each run is more than twice
+     * as large as the next one, so this is enough for any number of elements an
+     * int can count, plus one new run before it's merged.
+     */
+    #define TIME_BUCKET_RUNS 34
+
+    /*
+     * TIME_MEDIAN_STEPS:
+     * the maximum number of keys the last median found is moved by to find the
+     * current one, before it's searched for from scratch instead.
+     */
+    #define TIME_MEDIAN_STEPS 16
+
+	/*
+	 * time_entry:
+	 * a key along with the timestamp it was inserted with.
+	 */
+    typedef struct time_entry {
+        long time;
+        int key;
+    } time_entry;
+
+	/*
+	 * time_run:
+	 * an array of "count" entries, sorted by their keys.
+	 */
+    typedef struct time_run {
+        time_entry *entries;
+        int count;
+    } time_run;
+
+	/*
+	 * time_bucket:
+	 * holds the entries whose timestamps fall in one time slice of width
+	 * "bucket_width" (see below), numbered by "index" (-1 if the bucket is unused).
+	 * "runs" holds "runs_count" sorted runs, each more than twice as large as the
+	 * next, and "pending" collects up to "pending_size" new entries, "pending_count"
+	 * of them currently, unsorted, until they are sorted into a new run. "oldest" is
+	 * the oldest timestamp held by the bucket. once a newer bucket is used, the bucket
+	 * is "sealed": its runs are merged into one, "order" holds the positions of the
+	 * run's entries sorted by their timestamps, the first "expired_count" of which
+	 * have expired, and "expired_tree" is a binary indexed tree over the run's
+	 * positions, counting the expired ones.
+	 */
+    typedef struct time_bucket {
+        long index;
+        time_run runs[TIME_BUCKET_RUNS];
+        int runs_count;
+        time_entry *pending;
+        int pending_count;
+        long oldest;
+        int sealed;
+        int *order;
+        int *expired_tree;
+        int expired_count;
+    } time_bucket;
+
+	/*
+	 * time_window_heap:
+	 * is a structure that returns the median of the elements inserted during the
+	 * last "window" time units. it keeps a ring of "buckets_count" buckets, each
+	 * covering "bucket_width" time units, "newest_index" is the index of the latest
+	 * bucket used so far, "newest_time" is the latest timestamp seen so far, and
+	 * "elements_count" is the total number of elements held by all the buckets.
+	 * "median" is the last median found, and "less_count" and "at_most_count" are
+	 * the numbers of elements held which are smaller than it and not larger than it,
+	 * kept up to date with each change (if "median_valid" is not 0).
+	 */
+    typedef struct time_window_heap {
+        time_bucket *buckets;
+        int buckets_count;
+        int pending_size;
+        long window;
+        long bucket_width;
+        long newest_index;
+        long newest_time;
+        int elements_count;
+        int median;
+        int median_valid;
+        int less_count;
+        int at_most_count;
+    } time_window_heap;
+
+    time_window_heap *construct_time_window_heap(long, int, int);
+    void free_time_window_heap(time_window_heap*);
+    void time_window_heap_insert(time_window_heap*, long, int);
+    int time_window_heap_median(time_window_heap*, long);
+    int time_window_heap_items_count(time_window_heap*, long);
+
+#endif
\ No newline at end of file